@@ -0,0 +1,340 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+// xson-bench: throughput benchmarks, built as its own program so that the
+// allocation counter below stays out of the test runner.
+//
+//   xson-bench [section...]    sections: throughput query projection bind (default: all)
+
+import std;
+import xson;
+
+using namespace std::string_literals;
+using namespace xson;
+
+namespace xson::bench {
+
+// Allocations made on the measuring thread.
+thread_local std::size_t allocations = 0;
+
+} // namespace xson::bench
+
+void* operator new(std::size_t size)
+{
+    ++xson::bench::allocations;
+    if(auto p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace xson::bench {
+
+struct address
+{
+    std::string city;
+    int zip = 0;
+};
+
+} // namespace xson::bench
+
+template<>
+struct xson::bind::fields<xson::bench::address>
+{
+    using T = xson::bench::address;
+    static constexpr auto value = std::tuple{
+        field{"city", &T::city},
+        field{"zip", &T::zip}
+    };
+};
+
+namespace xson::bench {
+
+struct corpus
+{
+    std::string name;
+    std::vector<std::string> documents;
+    std::size_t bytes = 0;
+};
+
+// Generated corpora: small API messages, large arrays, deep nesting and
+// string-heavy documents, roughly one to two megabytes each.
+std::vector<corpus> make_corpora()
+{
+    const auto n = [](auto value) { return std::to_string(value); };
+    auto corpora = std::vector<corpus>{};
+
+    auto& api = corpora.emplace_back(corpus{"api"});
+    for(auto i = 0; i < 5000; ++i)
+        api.documents.push_back(R"({"id":)" + n(i) + R"(,"method":"GET","path":"/v1/users/)" + n(i % 977)
+                                + R"(","status":)" + n(i % 7 ? 200 : 404) + R"(,"latency":)" + n(i % 50) + ".25"
+                                + R"(,"ok":)" + (i % 7 ? "true"s : "false"s) + R"(,"user":{"name":"u)" + n(i % 31)
+                                + R"(","age":)" + n(18 + i % 60) + R"(,"roles":["read","write"]},"trace":null})");
+
+    auto& arrays = corpora.emplace_back(corpus{"arrays"});
+    for(auto i = 0; i < 10; ++i)
+    {
+        auto text = R"({"series":)"s + n(i) + R"(,"values":[)";
+        for(auto j = 0; j < 10000; ++j)
+            text += (j ? ","s : ""s) + (j % 2 ? n(i * 10000 + j) : n(j) + ".5");
+        arrays.documents.push_back(text + "]}");
+    }
+
+    auto& deep = corpora.emplace_back(corpus{"deep"});
+    for(auto i = 0; i < 500; ++i)
+    {
+        auto text = ""s;
+        for(auto d = 0; d < 100; ++d)
+            text += d % 2 ? "[" : R"({"level":)" + n(d) + R"(,"next":)";
+        text += n(i);
+        for(auto d = 99; d >= 0; --d)
+            text += d % 2 ? "]" : "}";
+        deep.documents.push_back(text);
+    }
+
+    auto& strings = corpora.emplace_back(corpus{"strings"});
+    for(auto i = 0; i < 500; ++i)
+    {
+        auto text = R"({"title":"Document )"s + n(i) + R"(","paragraphs":[)";
+        for(auto j = 0; j < 20; ++j)
+            text += (j ? ","s : ""s) + R"(")" + std::string(80, static_cast<char>('a' + (i + j) % 26))
+                  + R"( \"quoted\" Räksy ä\n\té )" + n(j) + R"(")";
+        strings.documents.push_back(text + "]}");
+    }
+
+    for(auto& c : corpora)
+        for(const auto& d : c.documents)
+            c.bytes += d.size();
+    return corpora;
+}
+
+struct measurement
+{
+    double seconds = 0.0;
+    std::size_t allocations = 0;
+};
+
+// Runs f once per document and reports wall time and allocations.
+template<typename F>
+measurement measure(const std::vector<std::string>& documents, F&& f)
+{
+    const auto before = allocations;
+    const auto start = std::chrono::steady_clock::now();
+    for(const auto& d : documents)
+        f(d);
+    const auto elapsed = std::chrono::duration<double>{std::chrono::steady_clock::now() - start};
+    return {elapsed.count(), allocations - before};
+}
+
+void report(std::string_view corpus, std::string_view operation, std::size_t documents,
+            std::size_t bytes, const measurement& m)
+{
+    std::cout << std::format("{:8} {:22} {:9.1f} MB/s {:11.0f} docs/s {:9.1f} allocs/doc\n", corpus, operation,
+                             bytes / m.seconds / 1e6, documents / m.seconds,
+                             static_cast<double>(m.allocations) / documents);
+}
+
+// Runs f once and returns its result with the wall time in milliseconds.
+template<typename F>
+auto timed(F&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto result = f();
+    return std::pair{std::move(result),
+                     std::chrono::duration<double, std::milli>{std::chrono::steady_clock::now() - start}.count()};
+}
+
+// The timed variants must agree; a benchmark of a wrong result is worthless.
+void check(bool agree, std::string_view what)
+{
+    if(not agree)
+        throw std::runtime_error{"xson-bench: "s + std::string{what} + " disagree"s};
+}
+
+// json::parse (string and stream), stringify, FSON encode/decode and
+// matching over each corpus.
+void throughput()
+{
+    const auto corpora = make_corpora();
+    const auto selector = json::parse(R"({"status":{"$gte":400},"user":{"roles":{"$in":["write"]}}})");
+    const auto plan = query::compile(selector);
+
+    for(const auto& c : corpora)
+    {
+        const auto count = c.documents.size();
+        auto parsed = std::vector<object>{};
+        parsed.reserve(count);
+        auto encoded = std::vector<std::string>{};
+        encoded.reserve(count);
+
+        report(c.name, "json::parse(sv)", count, c.bytes,
+               measure(c.documents, [&](const auto& d) { parsed.push_back(json::parse(d)); }));
+
+        report(c.name, "json::parse(istream)", count, c.bytes, measure(c.documents, [](const auto& d) {
+            auto is = std::istringstream{d};
+            json::parse(is);
+        }));
+
+        auto i = 0uz;
+        auto stringified = 0uz;
+        auto m = measure(c.documents, [&](const auto&) { stringified += json::stringify(parsed[i++], 0).size(); });
+        report(c.name, "json::stringify", count, stringified, m);
+
+        i = 0;
+        auto fson_bytes = 0uz;
+        m = measure(c.documents, [&](const auto&) {
+            auto& bytes = encoded.emplace_back();
+            fson::encoder{}.encode(bytes, parsed[i++]);
+            fson_bytes += bytes.size();
+        });
+        report(c.name, "fson::encode", count, fson_bytes, m);
+
+        i = 0;
+        m = measure(c.documents, [&](const auto&) { fson::parse(std::span{encoded[i++]}); });
+        report(c.name, "fson::parse", count, fson_bytes, m);
+
+        i = 0;
+        auto matches = 0uz;
+        m = measure(c.documents, [&](const auto&) { matches += parsed[i++].match(selector); });
+        report(c.name, "object::match", count, c.bytes, m);
+
+        i = 0;
+        auto planned = 0uz;
+        m = measure(c.documents, [&](const auto&) { planned += plan.match(parsed[i++]); });
+        report(c.name, "query::plan::match", count, c.bytes, m);
+
+        check(matches == planned, "object::match and query::plan::match");
+        check(json::stringify(parsed.front(), 0) == json::stringify(fson::parse(std::span{encoded.front()}), 0),
+              "JSON and FSON round trips");
+    }
+}
+
+// object::match against a compiled plan, sequential and across all threads.
+void compiled_plans()
+{
+    const auto n = [](int value) { return std::to_string(value); };
+    auto batch = std::vector<object>{};
+    for(auto i = 0; i < 20000; ++i)
+        batch.push_back(json::parse(
+            R"({"_id":)"s + n(i) + R"(,"name":"user)" + n(i) + R"(","age":)" + n(18 + i % 60)
+            + R"(,"tags":["t)" + n(i % 5) + R"(","t)" + n(i % 11) + R"("],"address":{"city":"c)" + n(i % 13)
+            + R"(","zip":)" + n(10000 + i % 97) + "}}"));
+
+    const auto selector = json::parse(
+        R"({"age":{"$gte":30,"$lt":50},"address":{"city":{"$in":["c1","c4","c7","c9"]}},"$top":100})");
+    const auto plan = query::compile(selector);
+
+    const auto [interpreted, interpreted_ms] = timed([&]{
+        return static_cast<std::size_t>(std::ranges::count_if(batch, [&](const object& ob){ return ob.match(selector); }));
+    });
+    const auto [compiled, compiled_ms] = timed([&]{ return plan.count(batch); });
+    const auto [parallel, parallel_ms] = timed([&]{ return plan.count(batch, 0); });
+
+    check(interpreted == compiled and interpreted == parallel, "object::match and query::plan::count");
+    std::cout << std::format("match {:.2f} ms, compiled {:.2f} ms ({:.1f}x), parallel {:.2f} ms ({} documents, {} matches)\n",
+                             interpreted_ms, compiled_ms, interpreted_ms / compiled_ms, parallel_ms, batch.size(), compiled);
+}
+
+// Extracting records from a parsed tree against binding them directly.
+void binding()
+{
+    const auto n = [](int value) { return std::to_string(value); };
+    auto text = "["s;
+    for(auto i = 0; i < 20000; ++i)
+        text += (i ? ","s : ""s) + R"({"city":"c)" + n(i % 13) + R"(","zip":)" + n(10000 + i % 97)
+              + R"(,"population":)" + n(i * 7) + R"(,"tags":["t1","t2"]})";
+    text += "]";
+
+    const auto [tree, tree_ms] = timed([&]{
+        auto result = std::vector<address>{};
+        const auto document = json::parse(text);
+        for(const auto& element : document.get<object::array>())
+            result.push_back({element["city"s].get<string_type>(),
+                              static_cast<int>(static_cast<integer_type>(element["zip"s]))});
+        return result;
+    });
+    const auto [bound, bound_ms] = timed([&]{ return bind::from_json<std::vector<address>>(text); });
+
+    check(bind::to_json(tree, 0) == bind::to_json(bound, 0), "tree extraction and binding");
+    std::cout << std::format("parse + extract {:.2f} ms, bind {:.2f} ms ({:.1f}x, {} records)\n",
+                             tree_ms, bound_ms, tree_ms / bound_ms, bound.size());
+}
+
+// Full parse against a parse projected onto the members a selector reads.
+void projected_parse()
+{
+    const auto n = [](int value) { return std::to_string(value); };
+    auto documents = std::vector<std::string>{};
+    for(auto i = 0; i < 5000; ++i)
+    {
+        auto history = ""s;
+        for(auto j = 0; j < 20; ++j)
+            history += (j ? ","s : ""s) + R"({"at":"2024-01-)" + n(1 + j) + R"(","note":"event ä )" + n(j)
+                     + R"(","values":[1.5,2.5,3.5]})";
+        documents.push_back(R"({"_id":)" + n(i) + R"(,"age":)" + n(18 + i % 60) + R"(,"address":{"city":"c)"
+                            + n(i % 13) + R"(","zip":)" + n(10000 + i % 97) + R"(},"history":[)" + history + "]}");
+    }
+    const auto selector = json::parse(R"({"age":{"$gte":30,"$lt":50},"address":{"city":{"$in":["c1","c4"]}}})");
+    const auto plan = query::compile(selector);
+    const auto projected = json::projection::from_selector(selector);
+
+    const auto [full, full_ms] = timed([&]{
+        return std::ranges::count_if(documents, [&](const auto& d) { return plan.match(json::parse(d)); });
+    });
+    const auto [sparse, sparse_ms] = timed([&]{
+        return std::ranges::count_if(documents, [&](const auto& d) { return plan.match(json::parse(d, projected)); });
+    });
+
+    check(full == sparse, "full and projected parse");
+    std::cout << std::format("full parse {:.2f} ms, projected {:.2f} ms ({:.1f}x, {} documents, {} matches)\n",
+                             full_ms, sparse_ms, full_ms / sparse_ms, documents.size(), sparse);
+}
+
+struct section
+{
+    std::string_view name;
+    void (*run)();
+};
+
+constexpr auto sections = std::array{
+    section{"throughput", throughput},
+    section{"query", compiled_plans},
+    section{"projection", projected_parse},
+    section{"bind", binding},
+};
+
+} // namespace xson::bench
+
+int main(int argc, char* argv[])
+{
+    using namespace xson::bench;
+    try
+    {
+        const auto selected = std::vector<std::string_view>(argv + 1, argv + argc);
+        for(const auto& name : selected)
+            if(std::ranges::find(sections, name, &section::name) == sections.end())
+                throw std::runtime_error{"xson-bench: unknown section "s + std::string{name}};
+        for(const auto& s : sections)
+            if(selected.empty() or std::ranges::find(selected, s.name) != selected.end())
+            {
+                std::cout << "== " << s.name << '\n';
+                s.run();
+            }
+        return 0;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,258 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import xson;
+import tester;
+
+using namespace std::string_literals;
+using namespace xson;
+
+namespace xson::bind_test {
+
+struct address
+{
+    std::string city;
+    int zip = 0;
+};
+
+struct person
+{
+    std::string name;
+    std::int64_t id = 0;
+    double score = 0.0;
+    bool active = false;
+    std::optional<std::string> nickname;
+    std::vector<std::string> tags;
+    address home;
+    std::optional<address> work;
+    std::vector<address> previous;
+    std::vector<std::vector<int>> matrix;
+    timestamp_type joined;
+    int untouched = 7;
+    std::uint64_t big = 0;
+};
+
+} // namespace xson::bind_test
+
+template<>
+struct xson::bind::fields<xson::bind_test::address>
+{
+    using T = xson::bind_test::address;
+    static constexpr auto value = std::tuple{
+        field{"city", &T::city},
+        field{"zip", &T::zip}
+    };
+};
+
+template<>
+struct xson::bind::fields<xson::bind_test::person>
+{
+    using T = xson::bind_test::person;
+    static constexpr auto value = std::tuple{
+        field{"name", &T::name},
+        field{"id", &T::id},
+        field{"score", &T::score},
+        field{"active", &T::active},
+        field{"nickname", &T::nickname},
+        field{"tags", &T::tags},
+        field{"home", &T::home},
+        field{"work", &T::work},
+        field{"previous", &T::previous},
+        field{"matrix", &T::matrix},
+        field{"joined", &T::joined},
+        field{"untouched", &T::untouched},
+        field{"big", &T::big}
+    };
+};
+
+namespace xson::bind_test {
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    const auto text = R"({"name":"Räksy","id":42,"score":1e2,"active":true,"nickname":null,)"
+                      R"("unknown":{"deep":[1,{"x":[]},"s"],"n":null},"tags":["a","b"],)"
+                      R"("home":{"city":"Oulu","zip":90100,"extra":[true]},"work":{"city":"Espoo"},)"
+                      R"("previous":[{"city":"Turku","zip":20100},{}],"matrix":[[1,2],[],[3]],)"
+                      R"("joined":"2024-05-01T12:30:00.000Z","more":[[[]]]})"s;
+
+    test_case("BindDecodesJson, [xson]") = [text] {
+        const auto p = bind::from_json<person>(text);
+        require_eq("Räksy"s, p.name);
+        require_eq(42, p.id);
+        require_eq(100.0, p.score);
+        require_true(p.active);
+        require_false(p.nickname.has_value());
+        require_true(p.tags == std::vector<std::string>{"a", "b"});
+        require_eq("Oulu"s, p.home.city);
+        require_eq(90100, p.home.zip);
+        require_true(p.work.has_value());
+        require_eq("Espoo"s, p.work->city);
+        require_eq(0, p.work->zip);
+        require_eq(2u, p.previous.size());
+        require_eq("Turku"s, p.previous[0].city);
+        require_eq(""s, p.previous[1].city);
+        require_true(p.matrix == std::vector<std::vector<int>>{{1, 2}, {}, {3}});
+        require_eq(xson::to_time_point("2024-05-01T12:30:00.000Z"), p.joined);
+        // Absent members keep their value.
+        require_eq(7, p.untouched);
+
+        // Decoding into an existing value replaces arrays and keeps the rest.
+        auto q = p;
+        bind::from_json(R"({"tags":["c"],"nickname":"R","work":{"zip":2150}})", q);
+        require_true(q.tags == std::vector<std::string>{"c"});
+        require_eq("R"s, q.nickname.value());
+        require_eq("Espoo"s, q.work->city);
+        require_eq(2150, q.work->zip);
+        require_eq("Oulu"s, q.home.city);
+
+        auto is = std::istringstream{text};
+        require_eq(p.name, bind::from_json<person>(is).name);
+
+        // Unsigned members take their whole range, written and read as exact digits.
+        constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+        q.big = max;
+        const auto encoded = bind::to_json(q, 0);
+        require_true(encoded.contains(R"("big":18446744073709551615)"));
+        require_eq(max, bind::from_json<person>(encoded).big);
+        auto big = std::istringstream{encoded};
+        require_eq(max, bind::from_json<person>(big).big);
+        require_eq(std::uint64_t{10000000000000000000u}, bind::from_json<person>(R"({"big":10000000000000000000})").big);
+        require_eq(std::uint64_t{10000000000000000000u}, bind::from_json<person>(R"({"big":1e19})").big);
+        require_throws([]{ bind::from_json<person>(R"({"big":18446744073709551616})"); });
+        require_throws([]{ bind::from_json<person>(R"({"big":-1})"); });
+        require_throws([]{ bind::from_json<person>(R"({"id":9223372036854775808})"); });
+    };
+
+    test_case("BindMatchesObjectModel, [xson]") = [text] {
+        const auto p = bind::from_json<person>(text);
+        const auto document = json::parse(text);
+        require_eq(document["name"s].get<string_type>(), p.name);
+        require_eq(static_cast<integer_type>(document["home"s]["zip"s]), integer_type{p.home.zip});
+
+        // The mirror encoder writes every mapped member, in mapping order.
+        const auto encoded = bind::to_json(p, 0);
+        require_eq(R"({"name":"Räksy","id":42,"score":100,"active":true,"nickname":null,"tags":["a","b"],)"
+                   R"("home":{"city":"Oulu","zip":90100},"work":{"city":"Espoo","zip":0},)"
+                   R"("previous":[{"city":"Turku","zip":20100},{"city":"","zip":0}],"matrix":[[1,2],[],[3]],)"
+                   R"("joined":"2024-05-01T12:30:00.000Z","untouched":7,"big":0})"s, encoded);
+        require_eq(json::parse(encoded), json::parse(bind::to_json(p)));
+
+        const auto round_trip = bind::from_json<person>(bind::to_json(p));
+        require_eq(encoded, bind::to_json(round_trip, 0));
+
+        auto buffer = std::vector<char>{'>'};
+        bind::to_json(buffer, p.home, json::format{0});
+        require_eq(R"(>{"city":"Oulu","zip":90100})"s, std::string(buffer.begin(), buffer.end()));
+    };
+
+    test_case("BindDecodesFson, [xson]") = [text] {
+        const auto expected = bind::from_json<person>(text);
+        const auto document = json::parse(text);
+        for(const auto layout : {fson::layout::v1, fson::layout::v2, fson::layout::v3})
+        {
+            auto bytes = std::string{};
+            fson::encoder{layout}.encode(bytes, document);
+            const auto p = bind::from_fson<person>(bytes);
+            require_eq(bind::to_json(expected, 0), bind::to_json(p, 0));
+
+            auto is = std::istringstream{bytes};
+            require_eq(expected.matrix.size(), bind::from_fson<person>(is).matrix.size());
+        }
+    };
+
+    test_case("BindEncodesFson, [xson]") = [text] {
+        const auto p = bind::from_json<person>(text);
+        const auto bytes = bind::to_fson(p);
+        require_eq(bind::to_json(p, 0), bind::to_json(bind::from_fson<person>(bytes), 0));
+        require_eq(json::parse(bind::to_json(p)), json::parse(json::stringify(fson::parse(bytes))));
+
+        auto buffer = std::vector<char>{'>'};
+        bind::to_fson(buffer, p.previous);
+        require_eq('>', buffer.front());
+        require_eq(bind::to_json(p.previous, 0),
+                   bind::to_json(bind::from_fson<std::vector<address>>(std::span{buffer}.subspan(1)), 0));
+
+        auto os = std::ostringstream{};
+        bind::to_fson(os, p);
+        require_eq(bytes, os.str());
+        auto is = std::istringstream{os.str()};
+        require_eq(p.matrix.size(), bind::from_fson<person>(is).matrix.size());
+
+        auto q = p;
+        q.work.reset();
+        q.big = std::uint64_t{1} << 62;
+        const auto round_trip = bind::from_fson<person>(bind::to_fson(q));
+        require_false(round_trip.work.has_value());
+        require_eq(q.big, round_trip.big);
+
+        q.big = std::numeric_limits<std::uint64_t>::max();
+        require_throws([&]{ bind::to_fson(q); });
+        require_throws([&]{ bind::to_fson(p, fson::layout::v2); });
+        require_throws([&]{ bind::to_fson(p, fson::layout::v3); });
+    };
+
+    test_case("BindRejectsMismatches, [xson]") = [] {
+        require_throws([]{ bind::from_json<person>(R"({"id":"42"})"); });
+        require_throws([]{ bind::from_json<person>(R"({"id":1.5})"); });
+        require_throws([]{ bind::from_json<person>(R"({"active":1})"); });
+        require_throws([]{ bind::from_json<person>(R"({"tags":"a"})"); });
+        require_throws([]{ bind::from_json<person>(R"({"home":[]})"); });
+        require_throws([]{ bind::from_json<person>(R"({"name":null})"); });
+        require_throws([]{ bind::from_json<person>(R"({"home":{"zip":4294967296}})"); });
+        require_throws([]{ bind::from_json<person>(R"([])"); });
+        require_throws([]{ bind::from_json<person>(R"({"name":"x")"); });
+        require_throws([]{ bind::from_json<std::vector<address>>(R"({})"); });
+        // Integral doubles fit integer members; integers fit double members.
+        require_eq(1000, bind::from_json<person>(R"({"id":1e3})").id);
+        require_eq(3.0, bind::from_json<person>(R"({"score":3})").score);
+    };
+
+    test_case("BindPerfectHash, [xson]") = [] {
+        static constexpr auto names = std::array<std::string_view, 6>{"a", "b", "id", "name", "$date", ""};
+        static constexpr auto table = bind::make_perfect_hash(names);
+        static_assert(table.find("name") == 3);
+        static_assert(table.find("nam") == names.size());
+
+        auto storage = std::vector<std::string>{};
+        for(auto i = 0; i < 500; ++i)
+            storage.push_back("field_"s + std::to_string(i));
+        auto many = std::array<std::string_view, 500>{};
+        std::ranges::copy(storage, many.begin());
+        const auto large = bind::make_perfect_hash(many);
+        for(auto i = 0uz; i < many.size(); ++i)
+            require_eq(i, large.find(many[i]));
+        require_eq(many.size(), large.find("field_500"));
+        require_eq(many.size(), large.find(""));
+        for(auto i = 0uz; i < names.size(); ++i)
+            require_eq(i, table.find(names[i]));
+    };
+
+    test_case("BindMatchesTreeExtraction, [xson]") = [] {
+        auto text = "["s;
+        for(auto i = 0; i < 50; ++i)
+            text += (i ? ","s : ""s) + R"({"city":"c)" + std::to_string(i % 13) + R"(","zip":)"
+                  + std::to_string(10000 + i % 97) + R"(,"population":)" + std::to_string(i * 7) + R"(,"tags":["t1","t2"]})";
+        text += "]";
+
+        auto tree = std::vector<address>{};
+        const auto document = json::parse(text);
+        for(const auto& element : document.get<object::array>())
+            tree.push_back({element["city"s].get<string_type>(),
+                            static_cast<int>(static_cast<integer_type>(element["zip"s]))});
+        const auto bound = bind::from_json<std::vector<address>>(text);
+
+        require_eq(50u, bound.size());
+        require_eq(bind::to_json(tree, 0), bind::to_json(bound, 0));
+    };
+
+    return 0;
+}
+
+const auto _ = register_tests();
+
+} // namespace xson::bind_test
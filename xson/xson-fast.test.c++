@@ -316,6 +316,111 @@ auto register_tests()
         require_eq(round_trip(after_epoch), after_epoch);
     };
 
+    test_case("Pointer encoders match stream encoders, [xson]") = [] {
+        auto values = std::vector<std::int64_t>{0, 1, -1, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()};
+        for(auto bits = 1; bits < 64; ++bits)
+            for(const auto v : {std::int64_t{1} << bits, (std::int64_t{1} << bits) - 1, -(std::int64_t{1} << bits), -(std::int64_t{1} << bits) + 1})
+                values.push_back(v);
+
+        const auto encoded = [](auto value)
+        {
+            char buffer[max_varint_bytes];
+            return std::string(buffer, xson::fast::encode(buffer, value));
+        };
+        const auto streamed = [](auto value)
+        {
+            auto ss = std::stringstream{};
+            xson::fast::encode(ss, value);
+            return ss.str();
+        };
+        for(const auto v : values)
+        {
+            require_eq(streamed(v), encoded(v));
+            require_eq(streamed(static_cast<std::uint64_t>(v)), encoded(static_cast<std::uint64_t>(v)));
+        }
+
+        for(const auto& str : {""s, "a"s, "\0"s, "\x01"s, "räksy"s, std::string(5000, '\x80') + "x"s})
+        {
+            auto ss = std::stringstream{};
+            xson::fast::encode(ss, str);
+            auto buffer = std::string(3 * str.size() + 1, '\0');
+            auto* end = xson::fast::encode(buffer.data(), std::string_view{str});
+            require_eq(ss.str(), std::string(buffer.data(), end));
+
+            // Pieces written with encode_run concatenate to the same bytes.
+            if(str.size() > 1)
+            {
+                auto pieces = std::string(3 * str.size() + 1, '\0');
+                auto* p = encode_run(pieces.data(), std::string_view{str}.substr(0, str.size() / 2));
+                p = xson::fast::encode(p, std::string_view{str}.substr(str.size() / 2));
+                require_eq(ss.str(), std::string(pieces.data(), p));
+            }
+
+            auto decoded = "stale"s;
+            const auto bytes = ss.str();
+            require_true(xson::fast::decode(bytes.data(), bytes.data() + bytes.size(), decoded) == bytes.data() + bytes.size());
+            require_eq(str, decoded);
+        }
+    };
+
+    test_case("Span varint decode with and without the single-load path, [xson]") = [] {
+        auto rng = std::mt19937_64{42};
+        auto values = std::vector<std::uint64_t>{0, 127, 128, 16383, 16384, (1ull << 56) - 1, 1ull << 56, ~0ull};
+        for(auto i = 0; i < 2000; ++i)
+            values.push_back(rng() >> (rng() % 64));
+
+        for(const auto u : values)
+        {
+            // Padded input takes the 64-bit load; exact input takes the byte loop.
+            char padded[max_varint_bytes + 8] = {};
+            auto* end = xson::fast::encode(padded, u);
+            const auto n = end - padded;
+            auto exact = std::string(padded, end);
+
+            auto a = std::uint64_t{};
+            auto b = std::uint64_t{};
+            require_true(xson::fast::decode(padded, padded + sizeof(padded), a) == end);
+            require_true(xson::fast::decode(exact.data(), exact.data() + n, b) == exact.data() + n);
+            require_eq(u, a);
+            require_eq(u, b);
+
+            const auto s = static_cast<std::int64_t>(u);
+            end = xson::fast::encode(padded, s);
+            exact.assign(padded, end);
+            auto c = std::int64_t{};
+            auto d = std::int64_t{};
+            require_true(xson::fast::decode(padded, padded + sizeof(padded), c) == end);
+            xson::fast::decode(exact.data(), exact.data() + exact.size(), d);
+            require_eq(s, c);
+            require_eq(s, d);
+        }
+
+        // Truncated input still throws rather than reading past the end.
+        const auto unterminated = std::string(12, '\x01');
+        auto u = std::uint64_t{};
+        require_throws([&]{ xson::fast::decode(unterminated.data(), unterminated.data() + 3, u); });
+        require_throws([&]{ xson::fast::decode(unterminated.data(), unterminated.data() + unterminated.size(), u); });
+    };
+
+    test_case("Fixed double round-trip, [xson]") = [] {
+        for(const auto d : {0.0, -0.0, 1.5, -2.25e-300, 1e300, std::numeric_limits<double>::denorm_min(),
+                            std::numeric_limits<double>::infinity()})
+        {
+            char buffer[8];
+            require_true(encode_fixed(buffer, d) == buffer + 8);
+            auto out = 0.0;
+            require_true(decode_fixed(buffer, buffer + 8, out) == buffer + 8);
+            require_eq(std::bit_cast<std::uint64_t>(d), std::bit_cast<std::uint64_t>(out));
+        }
+        // Little-endian on the wire.
+        char one[8];
+        encode_fixed(one, 1.0);
+        require_eq("\x00\x00\x00\x00\x00\x00\xf0\x3f"s, std::string(one, 8));
+
+        auto out = 0.0;
+        require_throws([&]{ decode_fixed(one, one + 7, out); });
+    };
+
     return 0;
 }
 
@@ -569,6 +569,247 @@ auto register_tests()
         }
     };
 
+    test_case("FSON v2 Round-trip, [xson]") = [] {
+        auto ob = json::parse(R"({"name":"Räksy\u0000x","n":-1.5,"i":-42,"t":true,"z":null,"e":{},"a":[],)"
+                              R"("list":[1,"two",[3],{"k":"v"}],"ts":"x"})");
+        ob["ts"s] = xson::timestamp_type{std::chrono::milliseconds{-1234}};
+
+        for(const auto threshold : {0uz, 1uz, encoder::default_index_threshold})
+        {
+            auto ss = std::stringstream{};
+            encoder{layout::v2, threshold}.encode(ss, ob);
+            const auto bytes = ss.str();
+            require_eq(static_cast<char>(type::version), bytes.front());
+
+            // The stream decoder reads v2 as well as v1.
+            auto in = std::stringstream{bytes};
+            require_eq(ob, fson::parse(in));
+            require_eq(ob, view{bytes}.to_object());
+        }
+
+        // v1 output is unchanged by default.
+        auto v1 = std::stringstream{};
+        encoder{}.encode(v1, ob);
+        auto v1_explicit = std::stringstream{};
+        encoder{layout::v1}.encode(v1_explicit, ob);
+        require_eq(v1.str(), v1_explicit.str());
+    };
+
+    test_case("FSON v2 Rejects Corrupt Sizes, [xson]") = [] {
+        // Size and count prefixes must match what the container holds.
+        for(const auto l : {layout::v2, layout::v3})
+        {
+            auto bytes = std::string{};
+            encoder{l, 0}.encode(bytes, json::parse(R"({"a":[1,2],"b":"x"})"));
+            const auto array = bytes.find(static_cast<char>(l == layout::v3 ? type::integers : type::array));
+            // Object size, object count, array size and array count are
+            // one-byte varints at these positions.
+            for(const auto at : {3uz, 4uz, array + 1, array + 2})
+                for(const auto delta : {-1, 1})
+                {
+                    auto corrupt = bytes;
+                    corrupt[at] = static_cast<char>(static_cast<std::uint8_t>(corrupt[at]) + delta);
+                    require_throws([&]{ fson::parse(corrupt); });
+                    auto in = std::stringstream{corrupt};
+                    require_throws([&]{ fson::parse(in); });
+                }
+            require_eq(json::parse(R"({"a":[1,2],"b":"x"})"), fson::parse(bytes));
+        }
+    };
+
+    test_case("FSON View, [xson]") = [] {
+        auto ob = object{};
+        for(auto i = 0; i < 100; ++i)
+            ob["key"s + std::to_string(i)] = object{"nested"s, {i, i + 1}};
+        ob["name"s] = "record"s;
+
+        for(const auto threshold : {0uz, encoder::default_index_threshold})
+        {
+            auto ss = std::stringstream{};
+            encoder{layout::v2, threshold}.encode(ss, ob);
+            const auto bytes = ss.str();
+            const auto root = view{std::span<const char>{bytes}};
+
+            require_true(root.is_object());
+            require_eq(101u, root.size());
+            require_eq("record"s, std::string{static_cast<std::string_view>(root["name"])});
+            require_eq(58, static_cast<xson::integer_type>(root["key57"]["nested"][1]));
+            require_eq(2u, root["key3"]["nested"].size());
+            require_false(root.has("key100"));
+            require_false(root.has(""));
+            require_throws([&]{ root["missing"]; });
+            require_throws([&]{ root["key1"]["nested"][2]; });
+
+            // The returned bytes are the member's own encoding.
+            const auto member = root["key42"].bytes();
+            require_true(member.data() > bytes.data() && member.data() + member.size() <= bytes.data() + bytes.size());
+
+            auto names = std::vector<std::string_view>{};
+            for(const auto& [name, value] : root)
+            {
+                names.push_back(name);
+                require_true(value.is_object() || value.is_string());
+            }
+            require_eq(101u, names.size());
+            require_true(std::ranges::is_sorted(names));
+        }
+    };
+
+    test_case("FSON View Rejects Malformed Input, [xson]") = [] {
+        // v1 documents have no length prefixes to navigate.
+        auto v1 = std::stringstream{};
+        encoder{}.encode(v1, object{"a"s, 1});
+        require_throws([&]{ view{v1.str()}; });
+
+        auto v2 = std::stringstream{};
+        encoder{layout::v2, 1}.encode(v2, object{"a"s, "text"s});
+        const auto bytes = v2.str();
+        for(auto n = 0uz; n < bytes.size(); ++n)
+        {
+            const auto truncated = bytes.substr(0, n);
+            require_throws([&]{ view{truncated}["a"]; });
+            auto in = std::stringstream{truncated};
+            require_throws([&]{ fson::parse(in); });
+        }
+    };
+
+    test_case("FSON v3 Packed Arrays, [xson]") = [] {
+        auto ob = json::parse(R"({"ints":[5,3,-9223372036854775808,9223372036854775807,0,0,1],)"
+                              R"("doubles":[1.5,-0.0,1e300,2.5e-308],"bools":[true,false,true,true,false,false,false,true,true],)"
+                              R"("mixed":[1,1.5],"strings":["a","b"],"nested":[[1,2],[true],[0.5]],"empty":[],)"
+                              R"("n":0.1,"i":7,"s":"text","z":null})");
+        ob["ts"s] = xson::timestamp_type{std::chrono::milliseconds{-1234}};
+
+        for(const auto threshold : {0uz, 1uz})
+        {
+            auto bytes = std::string{};
+            encoder{layout::v3, threshold}.encode(bytes, ob);
+            require_eq(static_cast<char>(type::version), bytes.front());
+
+            auto in = std::stringstream{bytes};
+            const auto streamed = fson::parse(in);
+            require_eq(ob, streamed);
+            require_true(streamed["ints"s][2].is_integer());
+            require_true(streamed["mixed"s][0].is_integer());
+            require_true(streamed["mixed"s][1].is_number());
+            require_eq(ob, fson::parse(bytes));
+
+            const auto root = view{bytes};
+            require_eq(ob, root.to_object());
+            require_true(root["ints"].is_array());
+            require_eq(static_cast<char>(type::integers), root["ints"].bytes().front());
+            require_eq(static_cast<char>(type::numbers), root["doubles"].bytes().front());
+            require_eq(static_cast<char>(type::booleans), root["bools"].bytes().front());
+            require_eq(static_cast<char>(type::array), root["mixed"].bytes().front());
+            require_eq(static_cast<char>(type::array), root["empty"].bytes().front());
+            require_eq(7u, root["ints"].size());
+            require_eq(std::numeric_limits<std::int64_t>::min(), static_cast<xson::integer_type>(root["ints"][2]));
+            require_eq(1e300, static_cast<xson::number_type>(root["doubles"][2]));
+            require_eq(0.1, static_cast<xson::number_type>(root["n"]));
+            require_true(static_cast<xson::boolean_type>(root["bools"][8]));
+            require_false(static_cast<xson::boolean_type>(root["bools"][7 - 1]));
+            require_throws([&]{ root["bools"][9]; });
+            require_true(root["bools"][0].bytes().empty());
+
+            auto sum = xson::integer_type{0};
+            for(const auto& [name, value] : root["ints"])
+            {
+                require_true(name.empty());
+                require_true(value.is_integer());
+                sum += static_cast<xson::integer_type>(value) % 100;
+            }
+            require_eq(5 + 3 - 8 + 7 + 1, sum);
+        }
+
+        // Packed arrays are a v3 feature; v2 documents keep tagged elements.
+        auto v2 = std::string{};
+        encoder{layout::v2}.encode(v2, ob);
+        require_eq(static_cast<char>(type::array), view{v2}["ints"].bytes().front());
+        require_eq(ob, fson::parse(v2));
+    };
+
+    test_case("FSON Buffer and Span Codec, [xson]") = [] {
+        auto ob = json::parse(R"({"name":"Räksy\u0000x","n":-1.5,"i":-42,"t":true,"z":null,"e":{},"a":[],)"
+                              R"("list":[1,"two",[3],{"k":"v"}]})");
+        ob["long"s] = std::string(20000, 'x') + "ä\x01"s + std::string(5000, '\x7f');
+        ob["ts"s] = xson::timestamp_type{std::chrono::milliseconds{-1234}};
+
+        for(const auto l : {layout::v1, layout::v2, layout::v3})
+        {
+            auto ss = std::stringstream{};
+            encoder{l}.encode(ss, ob);
+
+            // Buffer output appends the same bytes the stream encoder writes.
+            auto text = "prefix"s;
+            encoder{l}.encode(text, ob);
+            require_eq("prefix"s + ss.str(), text);
+            auto bytes = std::vector<char>{};
+            encoder{l}.encode(bytes, ob);
+            require_eq(ss.str(), std::string(bytes.begin(), bytes.end()));
+
+            require_eq(ob, fson::parse(bytes));
+            auto doc = pmr::document{};
+            require_eq(ob, fson::parse(bytes, doc).to_object());
+
+            // A span decode stops after one document.
+            auto twice = ss.str() + ss.str();
+            auto b = xson::builder{};
+            const auto* end = decoder<xson::builder>{b}.decode(twice);
+            require_true(end == twice.data() + ss.str().size());
+            require_eq(ob, b.get());
+            require_throws([&]{ fson::parse(twice); });
+        }
+    };
+
+    test_case("FSON v3 Time Series Size, [xson]") = [] {
+        auto samples = object::array{};
+        for(auto i = 0; i < 1000; ++i)
+            samples.push_back(object{{"t"s, object{1'700'000'000'000 + 1000ll * i}}, {"v"s, object{20.0 + 0.25 * (i % 17)}}});
+        auto columns = object{};
+        auto t = object::array{};
+        auto v = object::array{};
+        for(const auto& sample : samples)
+        {
+            t.push_back(sample["t"s]);
+            v.push_back(sample["v"s]);
+        }
+        columns["t"s] = object{std::move(t)};
+        columns["v"s] = object{std::move(v)};
+
+        auto sizes = std::array<std::size_t, 3>{};
+        for(const auto l : {layout::v1, layout::v2, layout::v3})
+        {
+            auto bytes = std::string{};
+            encoder{l}.encode(bytes, columns);
+            require_eq(columns, fson::parse(bytes));
+            sizes[static_cast<std::size_t>(l) - 1] = bytes.size();
+        }
+        // Columns of integers and doubles lose their per-element tags, the
+        // integers shrink to small deltas and doubles take 8 bytes, not 10.
+        succeed("v1 "s + std::to_string(sizes[0]) + ", v2 "s + std::to_string(sizes[1]) + ", v3 "s + std::to_string(sizes[2]) + " bytes"s);
+        require_true(sizes[2] * 3 < sizes[0] * 2);
+        require_true(sizes[2] * 3 < sizes[1] * 2);
+    };
+
+    test_case("FSON v3 Rejects Malformed Input, [xson]") = [] {
+        auto bytes = std::string{};
+        encoder{layout::v3, 1}.encode(bytes, json::parse(R"({"i":[1,2,3],"b":[true,false],"d":[1.5,2.5],"n":0.5})"));
+        for(auto n = 0uz; n < bytes.size(); ++n)
+        {
+            const auto truncated = bytes.substr(0, n);
+            require_throws([&]{ view{truncated}.to_object(); });
+            require_throws([&]{ fson::parse(truncated); });
+            auto in = std::stringstream{truncated};
+            require_throws([&]{ fson::parse(in); });
+        }
+
+        // Packed tags are not valid in a v2 document.
+        auto v2 = std::string{};
+        encoder{layout::v2}.encode(v2, json::parse("[1]"));
+        v2[2] = static_cast<char>(type::integers);
+        require_throws([&]{ fson::parse(v2); });
+        require_throws([&]{ view{v2}; });
+    };
 
     return 0;
 }
@@ -840,6 +840,49 @@ auto register_tests()
             ob["deep_mix"s]["level1"s]["arr"s][0]["nested"s]["value"s]));
     };
 
+    test_case("ContiguousAndStreamAgree, [xson]") = [] {
+        // decode(std::string_view) runs the single-pass scanner and
+        // decode(std::istream&) the state machine; both must accept and reject
+        // the same texts and build the same values.
+        const auto inputs = std::vector<std::string>{
+            R"({"a":[1,-0,2.5e-3,1E2,true,false,null,"x\ty\u00e4\ud83d\ude00"],"b":{}})",
+            R"(  [ [] , {} , [[ ]] , { "k" : { } } ]  )",
+            R"("plain")", "0", "-9223372036854775808", "9223372036854775808", "1e-400",
+            "[1,2", "[1,]", "{\"a\" 1}", "{\"a\":1,}", "{,}", "01", "-", "1.", ".5", "1e", "1e+",
+            "1e309", "tru", "nul", "[truex]", "\"\\x\"", "\"\\ud800\"", "\"\\udc00\"",
+            "\"\\ud800\\u0041\"", "\"a\nb\"", "[1 2]", "{\"a\":1}}", "", "   ", "\"abc",
+        };
+        for(const auto& input : inputs)
+        {
+            auto from_view = std::optional<xson::object>{};
+            auto from_stream = std::optional<xson::object>{};
+            try { from_view = json::parse(std::string_view{input}); } catch(const std::exception&) {}
+            try { auto ss = std::stringstream{input}; from_stream = json::parse(ss); } catch(const std::exception&) {}
+            require_eq(from_view.has_value(), from_stream.has_value());
+            if(from_view)
+                require_eq(*from_view, *from_stream);
+        }
+    };
+
+    test_case("ContiguousLongStringsAndWhitespace, [xson]") = [] {
+        // Escapes and closing quotes at every position relative to the
+        // 16/32-byte scanner blocks, separated by long whitespace runs.
+        for(auto length = 0uz; length < 80uz; ++length)
+        {
+            auto text = std::string(length, 'z');
+            auto expected = text;
+            if(length % 3 == 0 && length > 0)
+            {
+                text += "\\n\\u00e4";
+                expected += "\n\xC3\xA4";
+            }
+            const auto padding = std::string(length, length % 2 ? ' ' : '\n');
+            const auto json_text = "{"s + padding + "\"k\"" + padding + ":" + padding + "[\"" + text + "\"" + padding + "]" + padding + "}";
+            const auto ob = json::parse(std::string_view{json_text});
+            require_eq(expected, static_cast<const xson::string_type&>(ob["k"s][0]));
+        }
+    };
+
     return 0;
 }
 
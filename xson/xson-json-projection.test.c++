@@ -0,0 +1,164 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import xson;
+import tester;
+
+using namespace std::string_literals;
+using namespace xson;
+
+namespace xson::json_projection_test {
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    const auto text = R"({"_id":7,"name":"Räksy ä\n","big":{"blob":[1,2.5e3,"x\"y",{"deep":[null]}],"k":1},)"
+                      R"("a/b":{"x~y":true,"z":false},"list":[{"k":1,"v":2},3,[{"k":4,"w":5}],"s"],"tail":null})"s;
+
+    test_case("ProjectionKeepsPaths, [xson]") = [text] {
+        require_eq(json::parse(R"({"_id":7})"), json::parse(text, json::projection{"/_id"}));
+        require_eq(json::parse(text), json::parse(text, json::projection{""}));
+        require_eq(json::parse(R"({})"), json::parse(text, json::projection{}));
+        require_eq(json::parse(R"({})"), json::parse(text, json::projection{"/missing/x"}));
+
+        // A path ending at a member keeps its whole value; a longer path
+        // reduces the objects along it.
+        require_eq(json::parse(R"({"big":{"k":1},"name":"Räksy ä\n"})"),
+                   json::parse(text, json::projection{"/big/k", "/name"}));
+        require_eq(json::parse(R"({"big":{"blob":[1,2.5e3,"x\"y",{"deep":[null]}],"k":1}})"),
+                   json::parse(text, json::projection{"/big/k", "/big"}));
+        require_eq(json::parse(R"({"a/b":{"x~y":true}})"), json::parse(text, json::projection{"/a~1b/x~0y"}));
+
+        // Paths continue into every array element; scalars on a path are kept.
+        require_eq(json::parse(R"({"list":[{"k":1},3,[{"k":4}],"s"]})"), json::parse(text, json::projection{"/list/k"}));
+
+        // Numeric tokens are member names, not array indexes.
+        require_eq(json::parse(R"({"list":[1,{"0":2},[4,{"0":5}],"s"]})"),
+                   json::parse(R"({"list":[1,{"0":2,"1":3},[4,{"0":5,"x":6}],"s"],"n":0})", json::projection{"/list/0"}));
+        require_eq(json::parse(R"({"0":{"a":1}})"), json::parse(R"({"0":{"a":1,"b":2},"1":3})", json::projection{"/0/a"}));
+
+        const auto paths = std::vector<std::string>{"/tail", "/_id"};
+        require_eq(json::parse(R"({"_id":7,"tail":null})"), json::parse(text, json::projection{paths}));
+
+        // Non-object documents are unaffected.
+        require_eq(json::parse("[1,{}]"), json::parse("[1,{}]", json::projection{"/x"}));
+        require_eq(json::parse("5"), json::parse("5", json::projection{"/x"}));
+
+        auto doc = pmr::document{};
+        require_eq(json::parse(text, json::projection{"/list/k"}),
+                   json::parse(text, json::projection{"/list/k"}, doc).to_object());
+
+        require_throws([]{ json::projection{"a"}; });
+        require_throws([]{ json::projection{"/a~2"}; });
+    };
+
+    test_case("ProjectionValidatesSkippedText, [xson]") = [] {
+        const auto projected = json::projection{"/a"};
+        for(const auto* invalid : {
+            R"({"a":1,"b":"\x"})", R"({"a":1,"b":"\u12g4"})", R"({"a":1,"b":"\ud800"})",
+            "{\"a\":1,\"b\":\"\x01\"}", R"({"a":1,"b":"open)", R"({"a":1,"b\q":2})",
+            R"({"a":1,"b":01})", R"({"a":1,"b":1.})", R"({"a":1,"b":-})", R"({"a":1,"b":1e999})",
+            R"({"a":1,"b":[1,]})", R"({"a":1,"b":{"c"}})", R"({"a":1,"b":tru})", R"({"a":1,"b":[}})",
+            R"({"a":1,"b":{}} x)", R"({"a":1,"b":[])"})
+        {
+            require_throws([&]{ json::parse(invalid); });
+            require_throws([&]{ json::parse(invalid, projected); });
+        }
+
+        auto nested = std::string(2000, '[') + std::string(2000, ']');
+        require_throws([&]{ json::parse(R"({"a":1,"b":)"s + nested + "}", projected); });
+
+        // Skipped strings and names keep the string length limit, counted
+        // after unescaping as in a full parse.
+        const auto decode = [&](std::string_view text, bool project)
+        {
+            auto b = xson::builder{};
+            auto d = json::decoder<xson::builder>{b, 4};
+            if(project)
+                d.decode(text, projected);
+            else
+                d.decode(text);
+        };
+        for(const auto* too_long : {R"({"a":1,"b":"12345"})", R"({"a":1,"b":"1234\n"})", R"({"a":1,"b":"\u00e4\u00e4\u00e4"})",
+                                    R"({"a":1,"12345":0})", R"({"a":1,"b":["x","12345"]})"})
+        {
+            require_throws([&]{ decode(too_long, false); });
+            require_throws([&]{ decode(too_long, true); });
+        }
+        for(const auto* within : {R"({"a":1,"b":"1234"})", R"({"a":1,"b":"12\n\t"})", R"({"a":1,"b":"\u00e4\u00e4"})"})
+        {
+            decode(within, false);
+            decode(within, true);
+        }
+    };
+
+    test_case("ProjectionFromSelector, [xson]") = [] {
+        const auto documents = std::vector<std::string>{
+            R"({"a":1,"b":"x","c":[1,2],"d":{"e":2.5,"f":null},"$date":"2024-01-01","g":true,"h":{"i":[1,{"j":2}]}})",
+            R"({"a":1.0,"b":"y","c":[1,2,3],"d":{"e":-1},"$eq":1})",
+            R"({"a":9007199254740993,"b":["x"],"c":[],"d":[{"e":2.5}]})",
+            R"({"a":{"$gt":0},"b":null,"c":[[1],{"k":"v"}]})",
+            R"({"a":{"x":1,"y":[2]},"d":{"e":{"f":1}},"$top":2})",
+            R"({})", R"([])", R"([1,"x",{"a":1}])", R"(1)", R"("x")", R"(null)",
+        };
+        const auto selectors = std::vector<std::string>{
+            R"({})", R"([])", R"(1)", R"("x")", R"({"a":1})", R"({"a":1,"b":"x"})",
+            R"({"c":[1,2]})", R"({"c":[]})", R"({"c":[[1],{"k":"v"}]})", R"({"d":{"e":2.5}})", R"({"d":{}})",
+            R"({"d":{"f":null}})", R"({"d":[]})", R"({"$date":"2024-01-01"})", R"({"$eq":1})", R"({"$eq":1,"a":1})",
+            R"({"$top":2,"a":1})", R"({"a":{"$gt":0}})", R"({"a":{"$gt":0,"$lt":5}})", R"({"a":{"$gt":{}}})",
+            R"({"a":{"$in":[1,2]}})", R"({"a":{"$nin":[]}})", R"({"a":{"x":1}})", R"({"a":{"$gt":0,"x":1}})",
+            R"({"a":{"y":[2]}})", R"({"h":{"i":[1,{"j":2}]}})", R"({"d":{"e":{"f":1}}})", R"({"$gt":0})",
+            R"([1,"x",{"a":1}])", R"({"g":true,"b":{"$in":["x","y"]}})",
+        };
+
+        auto mismatches = ""s;
+        for(const auto& selector_text : selectors)
+        {
+            const auto selector = json::parse(selector_text);
+            const auto plan = query::compile(selector);
+            const auto projected = json::projection::from_selector(selector);
+            for(const auto& document : documents)
+            {
+                const auto full = json::parse(document);
+                const auto sparse = json::parse(document, projected);
+                if(full.match(selector) != sparse.match(selector) or plan.match(full) != plan.match(sparse))
+                    mismatches += selector_text + " on "s + document + "\n"s;
+            }
+        }
+        require_eq(""s, mismatches);
+
+        const auto selector = json::parse(R"({"age":{"$gte":30},"address":{"city":{"$in":["a"]}},"$top":5})");
+        require_eq(json::parse(R"({"address":{"city":"a"},"age":31})"),
+                   json::parse(R"({"_id":1,"age":31,"address":{"city":"a","zip":1},"tags":["t"]})",
+                               json::projection::from_selector(selector)));
+    };
+
+    test_case("ProjectionMatchesFullParse, [xson]") = [] {
+        const auto n = [](int value) { return std::to_string(value); };
+        const auto selector = json::parse(R"({"age":{"$gte":30,"$lt":50},"address":{"city":{"$in":["c1","c4"]}}})");
+        const auto plan = query::compile(selector);
+        const auto projected = json::projection::from_selector(selector);
+
+        auto full = 0;
+        auto sparse = 0;
+        for(auto i = 0; i < 100; ++i)
+        {
+            const auto document = R"({"_id":)" + n(i) + R"(,"age":)" + n(18 + i % 60) + R"(,"address":{"city":"c)"
+                                + n(i % 13) + R"(","zip":)" + n(10000 + i % 97) + R"(},"history":[{"at":"2024-01-01","values":[1.5]}]})";
+            full += plan.match(json::parse(document));
+            sparse += plan.match(json::parse(document, projected));
+        }
+        require_true(full > 0);
+        require_eq(full, sparse);
+    };
+
+    return 0;
+}
+
+const auto _ = register_tests();
+
+} // namespace xson::json_projection_test
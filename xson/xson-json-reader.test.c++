@@ -0,0 +1,152 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import xson;
+import tester;
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+using namespace xson;
+using namespace xson::json;
+
+namespace xson::json_reader_test {
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    const auto text = R"({"name":"Räksy 😀","n":-12.5e-1,"big":123456789012,"list":[true,false,null,[]],"o":{}})"s;
+
+    test_case("FeedEverySplitPoint, [xson]") = [text] {
+        // Chunk boundaries may fall inside strings, escapes, numbers and literals.
+        const auto expected = json::parse(text);
+        for(auto split = 0uz; split <= text.size(); ++split)
+        {
+            auto b = xson::builder{};
+            auto d = decoder<xson::builder>{b};
+            d.feed(std::span<const char>{text.data(), split});
+            d.feed(std::span<const char>{text.data() + split, text.size() - split});
+            d.finish();
+            require_eq(expected, b.get());
+        }
+    };
+
+    test_case("FeedByteAtATime, [xson]") = [text] {
+        auto b = xson::builder{};
+        auto d = decoder<xson::builder>{b};
+        for(const auto& c : text)
+        {
+            require_false(d.done());
+            d.feed(std::span<const char>{&c, 1});
+        }
+        require_true(d.done());
+        d.finish();
+        require_eq(json::parse(text), b.get());
+    };
+
+    test_case("FeedRejectsLikeParse, [xson]") = [] {
+        for(const auto bad : {"{\"a\":1", "[1,]", "tru", "\"abc", "1 2", "", "{\"a\":1}x"})
+        {
+            const auto chunk = std::string_view{bad};
+            auto b = xson::builder{};
+            auto d = decoder<xson::builder>{b};
+            require_throws([&]{
+                d.feed(std::span<const char>{chunk.data(), chunk.size()});
+                d.finish();
+            });
+        }
+        // Embedded NUL is rejected across chunks; a trailing NUL run is accepted.
+        {
+            auto b = xson::builder{};
+            auto d = decoder<xson::builder>{b};
+            const auto first = "[1]\0"sv;
+            d.feed(std::span<const char>{first.data(), first.size()});
+            require_throws([&]{ d.feed(std::span<const char>{" ", 1}); });
+        }
+        {
+            auto b = xson::builder{};
+            auto d = decoder<xson::builder>{b};
+            const auto chunk = "[1]\0\0"sv;
+            d.feed(std::span<const char>{chunk.data(), chunk.size()});
+            d.finish();
+            require_eq(1u, b.get().size());
+        }
+    };
+
+    test_case("ReaderPullEvents, [xson]") = [] {
+        auto r = json::reader{};
+        r.feed(R"({"a":[1,"x)");
+        auto events = std::vector<json::event>{};
+        for(const auto& e : r)
+            events.push_back(e);
+        // The string "x... is still open, so only completed tokens are visible.
+        require_eq(4u, events.size());
+        require_true(events[0] == json::event{event_type::start_object});
+        require_true(events[1] == json::event{event_type::name, xson::primitive{"a"s}});
+        require_true(events[2] == json::event{event_type::start_array});
+        require_true(events[3] == json::event{event_type::value, xson::primitive{xson::integer_type{1}}});
+        require_false(r.next().has_value());
+
+        r.feed(R"(y",null]})");
+        require_true(r.done());
+        r.finish();
+        events.clear();
+        while(auto e = r.next())
+            events.push_back(*e);
+        require_eq(4u, events.size());
+        require_true(events[0] == json::event{event_type::value, xson::primitive{"xy"s}});
+        require_true(events[1] == json::event{event_type::value, xson::primitive{}});
+        require_true(events[2] == json::event{event_type::end_array});
+        require_true(events[3] == json::event{event_type::end_object});
+    };
+
+    test_case("NdjsonReader, [xson]") = [] {
+        const auto stream = "{\"id\":1}\n\n  [2,3]\r\n\"four\"\n{\"id\":5,\"t\":\"a b\"}"s;
+        // Same documents regardless of how the stream is chunked.
+        for(auto chunk_size : {1uz, 3uz, 7uz, stream.size()})
+        {
+            auto r = json::ndjson_reader{};
+            auto documents = std::vector<xson::object>{};
+            for(auto i = 0uz; i < stream.size(); i += chunk_size)
+            {
+                r.feed(std::string_view{stream}.substr(i, chunk_size));
+                while(auto ob = r.next())
+                    documents.push_back(std::move(*ob));
+            }
+            r.finish();
+            while(auto ob = r.next())
+                documents.push_back(std::move(*ob));
+
+            require_eq(4u, documents.size());
+            require_eq(1, static_cast<xson::integer_type>(documents[0]["id"s]));
+            require_eq(2u, documents[1].size());
+            require_eq("four"s, static_cast<const xson::string_type&>(documents[2]));
+            require_eq("a b"s, static_cast<const xson::string_type&>(documents[3]["t"s]));
+        }
+    };
+
+    test_case("NdjsonReaderReportsLine, [xson]") = [] {
+        auto r = json::ndjson_reader{};
+        r.feed("{\"ok\":true}\n");
+        require_true(r.next().has_value());
+        auto message = ""s;
+        try
+        {
+            r.feed("{\"ok\":}\n");
+        }
+        catch(const std::runtime_error& e)
+        {
+            message = e.what();
+        }
+        require_contains(message, "NDJSON line 2");
+    };
+
+    return 0;
+}
+
+const auto _ = register_tests();
+
+} // namespace xson::json_reader_test
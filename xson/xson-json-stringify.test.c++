@@ -396,6 +396,91 @@ auto register_tests()
         std::locale::global(previous);
     };
 
+    test_case("StringifyExactLayout, [xson]") = [] {
+        const auto obj = json::parse(R"({"a":[1,{}],"b":{"c":null,"d":[]},"e":"x"})");
+        require_eq(R"({"a":[1,{}],"b":{"c":null,"d":[]},"e":"x"})"s, json::stringify(obj, 0));
+        require_eq("{\n"
+                   "  \"a\" : [\n"
+                   "    1,\n"
+                   "    {}\n"
+                   "  ],\n"
+                   "  \"b\" : {\n"
+                   "    \"c\" : null,\n"
+                   "    \"d\" : []\n"
+                   "  },\n"
+                   "  \"e\" : \"x\"\n"
+                   "}"s, json::stringify(obj, 2));
+
+        // The stream encoder and stringify produce the same bytes.
+        for(const auto indent : {0u, 3u})
+        {
+            auto ss = std::stringstream{};
+            encoder{indent}.encode(ss, obj);
+            require_eq(ss.str(), json::stringify(obj, indent));
+        }
+    };
+
+    test_case("StringifyToBuffer, [xson]") = [] {
+        const auto obj = json::parse(R"({"list":[1,2.5,"two",true,null],"nested":{"k":"v"}})");
+        for(const auto indent : {0u, 2u})
+        {
+            const auto expected = json::stringify(obj, indent);
+
+            // Appends after existing content.
+            auto text = "prefix:"s;
+            json::stringify_to(text, obj, {indent});
+            require_eq("prefix:"s + expected, text);
+
+            auto bytes = std::vector<char>{};
+            json::stringify_to(bytes, obj, {indent});
+            require_eq(expected, std::string(bytes.begin(), bytes.end()));
+
+            auto out = std::string{};
+            json::stringify_to(std::back_inserter(out), obj, {indent});
+            require_eq(expected, out);
+        }
+
+        // Fixed-size output through a pointer; the returned iterator marks the end.
+        auto buffer = std::array<char, 64>{};
+        const auto end = json::stringify_to(buffer.data(), object{"k"s, 1}, {0});
+        require_eq(R"({"k":1})"s, std::string(buffer.data(), end));
+    };
+
+    test_case("StringifyToEscapesLongStrings, [xson]") = [] {
+        // Escapes on both sides of the vector block boundaries.
+        auto raw = std::string(100, 'a');
+        for(const auto at : {0uz, 15uz, 16uz, 31uz, 32uz, 33uz, 64uz, 99uz})
+            raw[at] = "\"\\\n\x01"[at % 4];
+        raw += "ä\x1f";
+
+        auto expected = std::stringstream{};
+        write_json_string(expected, raw);
+
+        auto text = std::string{};
+        json::stringify_to(text, object{raw}, {0});
+        require_eq(expected.str(), text);
+        require_eq(raw, static_cast<xson::string_type>(json::parse(text)));
+    };
+
+    test_case("StringifyToShortestNumbers, [xson]") = [] {
+        const auto obj = object{"x"s, 0.1};
+        require_eq(R"({"x":0.10000000000000001})"s, json::stringify(obj, 0));
+
+        auto text = std::string{};
+        json::stringify_to(text, obj, {.indent = 0, .shortest_numbers = true});
+        require_eq(R"({"x":0.1})"s, text);
+
+        for(const auto d : {0.1, 1.0 / 3.0, 1e300, -2.5e-308, 123456789.123456789, 5e-324})
+        {
+            text.clear();
+            json::stringify_to(text, object{d}, {.indent = 0, .shortest_numbers = true});
+            require_eq(d, static_cast<xson::number_type>(json::parse(text)));
+        }
+
+        text.clear();
+        require_throws([&]{ json::stringify_to(text, object{std::numeric_limits<double>::infinity()}); });
+    };
+
     return 0;
 }
 
@@ -0,0 +1,144 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import xson;
+import tester;
+
+using namespace std::string_literals;
+using namespace xson;
+
+namespace xson::pmr_test {
+
+// Counts allocations passed through to an upstream resource.
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+
+    explicit counting_resource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) :
+    m_upstream{upstream}
+    {
+    }
+
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+
+private:
+
+    void* do_allocate(std::size_t size, std::size_t alignment) override
+    {
+        ++allocations;
+        bytes += size;
+        return m_upstream->allocate(size, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t size, std::size_t alignment) override
+    {
+        m_upstream->deallocate(p, size, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* m_upstream;
+};
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    const auto text = R"({"name":"Räksy","esc":"a\"bä","n":-1.5,"i":42,"t":true,"f":false,"z":null,)"
+                      R"("list":[1,"two",[],{"k":"v"}],"dup":1,"b":{"c":[null]},"dup":"last","a":0})"s;
+
+    test_case("PmrParseMatchesObjectModel, [xson]") = [text] {
+        auto doc = pmr::document{};
+        const auto& root = json::parse(text, doc);
+        require_eq(json::parse(text), root.to_object());
+
+        require_true(root.is_object());
+        require_eq("Räksy"s, std::string{static_cast<std::string_view>(root["name"])});
+        require_eq("a\"bä"s, std::string{static_cast<std::string_view>(root["esc"])});
+        require_eq(42, static_cast<xson::integer_type>(root["i"]));
+        require_eq(-1.5, static_cast<xson::number_type>(root["n"]));
+        require_true(root["z"].is_null());
+        require_eq(4u, root["list"].size());
+        require_eq("v"s, std::string{static_cast<std::string_view>(root["list"][3]["k"])});
+        // Duplicate keys keep the last value; members stay sorted.
+        require_eq("last"s, std::string{static_cast<std::string_view>(root["dup"])});
+        require_eq("a"s, std::string{root.get<pmr::object::map>().front().first});
+        require_false(root.has("missing"));
+        require_throws([&]{ root["missing"]; });
+
+        for(const auto scalar : {"17", "\"s\"", "null", "[]", "{}"})
+            require_eq(json::parse(scalar), json::parse(scalar, doc).to_object());
+    };
+
+    test_case("PmrParseStaysInArena, [xson]") = [text] {
+        auto upstream = counting_resource{};
+        auto fallback = counting_resource{};
+        auto* previous = std::pmr::set_default_resource(&fallback);
+
+        {
+            auto doc = pmr::document{&upstream};
+            json::parse(text, doc);
+            const auto first = upstream.allocations;
+            // A few geometrically growing arena blocks, not one per node.
+            require_true(first > 0 and first < 8);
+            // Each parse releases the previous arena, so the cost stays flat.
+            for(auto i = 0; i < 10; ++i)
+            {
+                const auto before = upstream.allocations;
+                json::parse(text, doc);
+                require_true(upstream.allocations - before <= first);
+            }
+        }
+
+        // A caller buffer large enough for the document avoids upstream entirely.
+        {
+            auto buffer = std::array<std::byte, 16 * 1024>{};
+            auto counted = counting_resource{};
+            auto doc = pmr::document{buffer.data(), buffer.size(), &counted};
+            json::parse(text, doc);
+            require_eq(0u, counted.allocations);
+        }
+
+        std::pmr::set_default_resource(previous);
+        require_eq(0u, fallback.allocations);
+    };
+
+    test_case("PmrFsonParse, [xson]") = [text] {
+        const auto expected = json::parse(text);
+        auto ss = std::stringstream{};
+        fson::encoder{}.encode(ss, expected);
+
+        auto doc = pmr::document{};
+        require_eq(expected, fson::parse(ss, doc).to_object());
+    };
+
+    test_case("PmrObjectCopiesIntoTargetResource, [xson]") = [text] {
+        auto doc = pmr::document{};
+        json::parse(text, doc);
+
+        auto other = counting_resource{};
+        auto copy = pmr::object{doc.root(), pmr::object::allocator_type{&other}};
+        require_true(copy == doc.root());
+        require_true(other.allocations > 0);
+        require_true(copy.get_allocator() == pmr::object::allocator_type{&other});
+        require_true(copy["list"].get_allocator() == copy.get_allocator());
+
+        // The copy outlives the arena it was made from.
+        doc.clear();
+        require_true(doc.root().empty());
+        require_eq(json::parse(text), copy.to_object());
+    };
+
+    return 0;
+}
+
+const auto _ = register_tests();
+
+} // namespace xson::pmr_test
@@ -0,0 +1,99 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import xson;
+import tester;
+
+using namespace std::string_literals;
+using namespace xson;
+
+namespace xson::query_test {
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    const auto documents = std::vector<object>{
+        json::parse(R"({"a":1,"b":"x","c":[1,2],"d":{"e":2.5,"f":null},"$date":"2024-01-01","g":true})"),
+        json::parse(R"({"a":1.0,"b":"y","c":[1,2,3],"d":{"e":-1},"$eq":1})"),
+        json::parse(R"({"a":9007199254740993,"b":["x"],"c":[],"d":[]})"),
+        json::parse(R"({"a":{"$gt":0},"b":null,"c":[[1],{"k":"v"}]})"),
+        json::parse(R"({})"),
+        json::parse(R"([])"),
+        json::parse(R"([1,"x",{"a":1}])"),
+        json::parse(R"(1)"),
+        json::parse(R"(2.5)"),
+        json::parse(R"("x")"),
+        json::parse(R"(null)"),
+        json::parse(R"(true)"),
+        object{xson::primitive{std::numeric_limits<double>::quiet_NaN()}},
+    };
+
+    const auto selectors = std::vector<std::string>{
+        R"({})", R"([])", R"(1)", R"(1.0)", R"("x")", R"(null)", R"(true)",
+        R"({"a":1})", R"({"a":1.0})", R"({"a":2})", R"({"b":"x"})", R"({"a":1,"b":"x"})",
+        R"({"c":[1,2]})", R"({"c":[]})", R"({"c":[1]})", R"({"c":[[1],{"k":"v"}]})", R"({"c":[[1],{}]})",
+        R"({"d":{"e":2.5}})", R"({"d":{}})", R"({"d":{"f":null}})", R"({"d":[]})",
+        R"({"$date":"2024-01-01"})", R"({"$eq":1})", R"({"$eq":1,"a":1})", R"({"$eq":1,"$top":2})",
+        R"({"$top":2})", R"({"$top":2,"a":1})", R"({"$skip":1,"$orderby":"a","$desc":true,"$head":1,"$tail":1})",
+        R"({"a":{"$gt":0}})", R"({"a":{"$gte":1}})", R"({"a":{"$lt":1}})", R"({"a":{"$lte":1.0}})",
+        R"({"a":{"$ne":1}})", R"({"a":{"$eq":9007199254740992}})", R"({"a":{"$eq":9007199254740993}})",
+        R"({"a":{"$gt":0,"$lt":5}})", R"({"a":{"$gt":0,"$top":1}})", R"({"a":{"$gt":{}}})", R"({"a":{"$gt":[1]}})",
+        R"({"a":{"$in":[1,2]}})", R"({"a":{"$in":[2,3]}})", R"({"a":{"$in":[1.0]}})", R"({"a":{"$in":[]}})",
+        R"({"a":{"$in":{"0":1,"1":"z"}}})", R"({"a":{"$in":[{},[]]}})", R"({"a":{"$in":42}})", R"({"a":{"$in":null}})",
+        R"({"a":{"$nin":[1,2]}})", R"({"a":{"$nin":[]}})", R"({"a":{"$nin":42}})", R"({"a":{"$nin":{"k":5}}})",
+        R"({"a":{"$in":[1,"x",true,null,2.5],"$nin":[2.5]}})", R"({"b":{"$in":["x","y"]}})", R"({"b":{"$in":[null]}})",
+        R"({"a":{"$date":1}})", R"({"a":{"x":1}})", R"({"a":{"$gt":0,"x":1}})", R"({"a":{"$in":[1],"x":1}})",
+        R"({"$gt":0})", R"({"$in":[1,"x"]})", R"({"$nin":[1]})", R"({"$lt":2,"$ne":1.5})",
+        R"([1,"x",{"a":1}])", R"([1,"x",{}])", R"([1,"x"])", R"([{"$gt":0},"x",{"a":1}])",
+    };
+
+    test_case("CompiledPlanMatchesObjectMatch, [xson]") = [documents, selectors] {
+        auto mismatches = ""s;
+        for(const auto& text : selectors)
+        {
+            const auto selector = json::parse(text);
+            const auto plan = query::compile(selector);
+            for(auto i = 0uz; i < documents.size(); ++i)
+                if(plan.match(documents[i]) != documents[i].match(selector))
+                    mismatches += text + " on document "s + std::to_string(i) + "\n"s;
+        }
+        require_eq(""s, mismatches);
+
+        // Keys are compared exactly, not normalized.
+        const auto plan = query::compile(json::parse(R"({"$in":[1],"a":1})"));
+        require_false(plan.match(json::parse(R"({"a":1})")));
+        require_true(plan.match(json::parse(R"({"$in":[1],"a":1})")));
+    };
+
+    test_case("CompiledPlanBatch, [xson]") = [] {
+        auto batch = std::vector<object>{};
+        for(auto i = 0; i < 5000; ++i)
+            batch.push_back(object{{"id"s, object{i}}, {"group"s, object{"g"s + std::to_string(i % 7)}}});
+
+        const auto selector = json::parse(R"({"id":{"$gte":100,"$lt":4000},"group":{"$in":["g1","g3"]}})");
+        const auto plan = query::compile(selector);
+
+        auto expected = std::vector<std::size_t>{};
+        for(auto i = 0uz; i < batch.size(); ++i)
+            if(batch[i].match(selector))
+                expected.push_back(i);
+
+        require_false(expected.empty());
+        for(const auto threads : {1u, 3u, 0u})
+        {
+            require_true(expected == plan.filter(batch, threads));
+            require_eq(expected.size(), plan.count(batch, threads));
+        }
+        require_true(plan.filter(std::span<const object>{}, 4).empty());
+    };
+
+    return 0;
+}
+
+const auto _ = register_tests();
+
+} // namespace xson::query_test
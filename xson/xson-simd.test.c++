@@ -0,0 +1,57 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import xson;
+import tester;
+
+using namespace std::string_literals;
+
+namespace xson::simd_test {
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    test_case("FindStringSpecialEveryOffset, [xson]") = [] {
+        succeed("simd isa: "s + std::string{xson::simd::isa()});
+        // Place each special byte at every offset of a 70-byte run so the
+        // 32-byte, 16-byte and scalar tail loops all report the first hit.
+        for(const char special : {'"', '\\', '\0', '\n', '\x1F'})
+        {
+            for(auto offset = 0uz; offset < 70uz; ++offset)
+            {
+                auto text = std::string(70, 'a');
+                text[offset] = special;
+                const auto* first = text.data();
+                require_eq(offset, static_cast<std::size_t>(xson::simd::find_string_special(first, first + text.size()) - first));
+            }
+        }
+        // High-bit (UTF-8) bytes and 0x20 are plain string content.
+        const auto plain = "\xC3\xA4\x7F \xFF"s + std::string(40, '~');
+        require_true(xson::simd::find_string_special(plain.data(), plain.data() + plain.size()) == plain.data() + plain.size());
+    };
+
+    test_case("SkipWhitespaceEveryOffset, [xson]") = [] {
+        const auto ws = " \t\r\n"s;
+        for(auto offset = 0uz; offset < 70uz; ++offset)
+        {
+            auto text = std::string{};
+            for(auto i = 0uz; i < offset; ++i)
+                text += ws[i % ws.size()];
+            text += "x  ";
+            const auto* first = text.data();
+            require_eq(offset, static_cast<std::size_t>(xson::simd::skip_whitespace(first, first + text.size()) - first));
+        }
+        const auto blank = std::string(50, ' ');
+        require_true(xson::simd::skip_whitespace(blank.data(), blank.data() + blank.size()) == blank.data() + blank.size());
+    };
+
+    return 0;
+}
+
+const auto _ = register_tests();
+
+} // namespace xson::simd_test
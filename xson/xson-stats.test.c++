@@ -0,0 +1,163 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import xson;
+import tester;
+
+using namespace std::string_literals;
+using namespace xson;
+
+namespace xson::stats_test {
+
+// Records the stats reported on the installing thread while in scope.
+class recorder
+{
+public:
+
+    recorder()
+    {
+        set_stats_hook([this, thread = std::this_thread::get_id()](const stats& s)
+        {
+            if(std::this_thread::get_id() == thread)
+                calls.push_back(s);
+        });
+    }
+
+    ~recorder()
+    {
+        set_stats_hook({});
+    }
+
+    stats take()
+    {
+        auto s = calls.at(0);
+        calls.clear();
+        return s;
+    }
+
+    std::vector<stats> calls;
+};
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    // 7 nodes, depth 3, names a b c plus strings "xy" and "d": 6 string bytes.
+    const auto text = R"({"a":[1,"xy",{"b":null}],"c":"d"})"s;
+
+    test_case("StatsHookReportsCalls, [xson]") = [text] {
+        require_true(current_stats_hook() == nullptr);
+        auto r = recorder{};
+        require_true(current_stats_hook() != nullptr);
+
+        const auto document = json::parse(text);
+        auto s = r.take();
+        require_eq("json::parse"s, std::string{s.operation});
+        require_eq(text.size(), s.bytes);
+        require_eq(7u, s.nodes);
+        require_eq(3u, s.max_depth);
+        require_eq(6u, s.string_bytes);
+        require_true(s.elapsed >= std::chrono::nanoseconds{0});
+
+        auto is = std::istringstream{text};
+        json::parse(is);
+        s = r.take();
+        require_eq(text.size(), s.bytes);
+        require_eq(7u, s.nodes);
+
+        auto doc = pmr::document{};
+        json::parse(text, doc);
+        require_eq(7u, r.take().nodes);
+
+        json::parse(text, json::projection{"/c"});
+        s = r.take();
+        require_eq("json::parse_projected"s, std::string{s.operation});
+        require_eq(text.size(), s.bytes);
+        require_eq(2u, s.nodes);
+        require_eq(2u, s.string_bytes);
+
+        const auto compact = json::stringify(document, 0);
+        s = r.take();
+        require_eq("json::stringify"s, std::string{s.operation});
+        require_eq(compact.size(), s.bytes);
+        require_eq(7u, s.nodes);
+        require_eq(3u, s.max_depth);
+        require_eq(6u, s.string_bytes);
+
+        auto buffer = std::array<char, 64>{};
+        const auto end = json::stringify_to(buffer.data(), document, {.indent = 0});
+        require_eq(static_cast<std::size_t>(end - buffer.data()), r.take().bytes);
+
+        auto os = std::ostringstream{};
+        json::encoder{}.encode(os, document);
+        s = r.take();
+        require_eq("json::encode"s, std::string{s.operation});
+        require_eq(os.str().size(), s.bytes);
+
+        json::parse("42");
+        s = r.take();
+        require_eq(1u, s.nodes);
+        require_eq(0u, s.max_depth);
+
+        // Exact unsigned integers reach bound members through the counting builder.
+        require_eq(std::numeric_limits<std::uint64_t>::max(), bind::from_json<std::uint64_t>("18446744073709551615"));
+        s = r.take();
+        require_eq("bind::from_json"s, std::string{s.operation});
+        require_eq(1u, s.nodes);
+
+        // Failed calls report nothing.
+        require_throws([]{ json::parse("[1,"); });
+        require_true(r.calls.empty());
+
+        for(const auto layout : {fson::layout::v1, fson::layout::v3})
+        {
+            auto bytes = std::string{};
+            fson::encoder{layout}.encode(bytes, document);
+            s = r.take();
+            require_eq("fson::encode"s, std::string{s.operation});
+            require_eq(bytes.size(), s.bytes);
+            require_eq(7u, s.nodes);
+            require_eq(3u, s.max_depth);
+
+            fson::parse(bytes);
+            s = r.take();
+            require_eq("fson::parse"s, std::string{s.operation});
+            require_eq(bytes.size(), s.bytes);
+            require_eq(7u, s.nodes);
+            require_eq(3u, s.max_depth);
+            require_eq(6u, s.string_bytes);
+
+            auto ss = std::stringstream{};
+            fson::encoder{layout}.encode(ss, document);
+            require_eq(bytes.size(), r.take().bytes);
+            fson::parse(ss);
+            s = r.take();
+            require_eq(bytes.size(), s.bytes);
+            require_eq(7u, s.nodes);
+        }
+    };
+
+    test_case("StatsCountingBuilder, [xson]") = [text] {
+        // Without a hook nothing is counted; the counting builder can wrap any
+        // builder for a decoder directly.
+        auto s = stats{};
+        auto b = xson::builder{};
+        auto counting = counting_builder{b, s};
+        auto d = json::decoder<counting_builder<xson::builder>>{counting};
+        d.decode(text);
+        require_eq(json::parse(text), b.get());
+        require_eq(7u, s.nodes);
+        require_eq(3u, s.max_depth);
+        require_eq(6u, s.string_bytes);
+        require_eq(text.size(), d.bytes_read());
+    };
+
+    return 0;
+}
+
+const auto _ = register_tests();
+
+} // namespace xson::stats_test